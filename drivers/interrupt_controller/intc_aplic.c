@@ -15,6 +15,7 @@
 #include <zephyr/irq.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/sys_io.h>
 #include <zephyr/devicetree.h>
 #include <zephyr/drivers/interrupt_controller/riscv_aplic.h>
 #include <zephyr/sw_isr_table.h>
@@ -95,15 +96,27 @@ struct aplic_config {
 
 struct aplic_data {
     struct k_spinlock lock;
-    uint32_t total_interrupts;
-    uint32_t direct_interrupts;
+    atomic_t total_interrupts;
+    atomic_t direct_interrupts;
     uint32_t hart_thresholds[CONFIG_MP_MAX_NUM_CPUS];
     uint32_t ie_shadow[(CONFIG_APLIC_MAX_IRQS + 31) / 32];
+    uint32_t sm_active_shadow[(CONFIG_APLIC_MAX_IRQS + 31) / 32];
 };
  
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define APLIC_CACHE_LINE_SIZE CONFIG_DCACHE_LINE_SIZE
+#else
+#define APLIC_CACHE_LINE_SIZE 64
+#endif
+
+/* Per-CPU ISR state, one cache line per CPU to avoid false sharing */
+struct aplic_cpu_state {
+    uint32_t save_irq;
+    const struct device *save_dev;
+} __aligned(APLIC_CACHE_LINE_SIZE);
+
 static const struct device *aplic_dev = NULL;
-static uint32_t save_irq[CONFIG_MP_MAX_NUM_CPUS];
-static const struct device *save_dev[CONFIG_MP_MAX_NUM_CPUS];
+static struct aplic_cpu_state aplic_cpu[CONFIG_MP_MAX_NUM_CPUS];
  
 static inline const struct device *aplic_get_dev(void)
 {
@@ -112,14 +125,12 @@ static inline const struct device *aplic_get_dev(void)
  
 static inline void aplic_write(const struct device *dev, mem_addr_t addr, uint32_t value)
 {
-
-    *(volatile uint32_t *)addr = value;
+    sys_write32(value, addr);
 }
 
 static inline uint32_t aplic_read(const struct device *dev, mem_addr_t addr)
 {
-
-    return *(volatile uint32_t *)addr;
+    return sys_read32(addr);
 }
  
 static inline mem_addr_t get_sourcecfg_addr(const struct device *dev, uint32_t irq_id)
@@ -159,7 +170,7 @@ void aplic_direct_mode_handler(const void *arg)
 
     atomic_inc(&aplic_handler_called);
 
-    if (!dev) {
+    if (unlikely(!dev)) {
         return;
     }
 
@@ -173,60 +184,42 @@ void aplic_direct_mode_handler(const void *arg)
     const struct _isr_table_entry *ite;
     uint32_t local_irq;
     uint32_t hw_irq;
-    bool processed_any = false;
-    save_irq[cpu_id] = 0;
-    save_dev[cpu_id] = NULL;
-    
+
+    aplic_cpu[cpu_id].save_irq = 0;
+    aplic_cpu[cpu_id].save_dev = NULL;
+
     while ((hw_irq = aplic_get_idc_claim(dev, cpu_id)) != 0) {
 
         local_irq = (hw_irq >> APLIC_IDC_TOPI_ID_SHIFT) & APLIC_IDC_TOPI_ID_MASK;
 
         if (local_irq == 0) {
-            save_irq[cpu_id] = 0;
-            save_dev[cpu_id] = NULL;
             continue;
         }
 
-        k_spinlock_key_t key = k_spin_lock(&data->lock);
-        data->total_interrupts++;
-        data->direct_interrupts++;
-        k_spin_unlock(&data->lock, key);
-        save_irq[cpu_id] = local_irq;
-        save_dev[cpu_id] = dev;
-        processed_any = true;
+        atomic_inc(&data->total_interrupts);
+        atomic_inc(&data->direct_interrupts);
+        aplic_cpu[cpu_id].save_irq = local_irq;
+        aplic_cpu[cpu_id].save_dev = dev;
 
         if (local_irq >= config->num_sources) {
             z_irq_spurious(NULL);
         }
 
-        bool isr_found = false;
         uint32_t irq_l2 = irq_to_level_2(local_irq) | RISCV_IRQ_MEXT;
         uint32_t isr_table_idx = z_get_sw_isr_table_idx(irq_l2);
-        
+
         if (isr_table_idx < CONFIG_NUM_IRQS) {
             ite = &_sw_isr_table[isr_table_idx];
 
             if ((ite->isr != NULL) && (ite->isr != &z_irq_spurious)) {
-                isr_found = true;
-                save_irq[cpu_id] = 0;
-                save_dev[cpu_id] = NULL;
+                aplic_cpu[cpu_id].save_irq = 0;
+                aplic_cpu[cpu_id].save_dev = NULL;
                 ite->isr(ite->arg);
             }
         }
-        
-        if (!isr_found && local_irq > 0 && local_irq <= config->num_sources) {
-            save_irq[cpu_id] = 0;
-            save_dev[cpu_id] = NULL;
-        }
-        
-        save_irq[cpu_id] = 0;
-        save_dev[cpu_id] = NULL;
-    }
-    
 
-    if (processed_any) {
-        save_irq[cpu_id] = 0;
-        save_dev[cpu_id] = NULL;
+        aplic_cpu[cpu_id].save_irq = 0;
+        aplic_cpu[cpu_id].save_dev = NULL;
     }
 }
  
@@ -246,13 +239,15 @@ static int aplic_configure_direct_mode(const struct device *dev)
     uint32_t default_target = ((0U & APLIC_TARGETCFG_HART_MASK) << APLIC_TARGETCFG_HART_SHIFT) |
                               (APLIC_DEFAULT_PRIORITY & APLIC_TARGETCFG_PRIORITY_MASK);
     
+    mem_addr_t sourcecfg_addr = config->base + APLIC_SOURCECFG_BASE;
+    mem_addr_t targetcfg_addr = config->base + APLIC_TARGET_BASE;
+
     for (uint32_t i = 1; i <= config->num_sources; i++) {
-        mem_addr_t sourcecfg_addr = get_sourcecfg_addr(dev, i);
-        mem_addr_t targetcfg_addr = get_targetcfg_addr(dev, i);
-        
         aplic_write(dev, sourcecfg_addr, APLIC_SOURCECFG_SM_INACTIVE);
-        
         aplic_write(dev, targetcfg_addr, default_target);
+
+        sourcecfg_addr += APLIC_SOURCECFG_SIZE;
+        targetcfg_addr += APLIC_TARGET_SIZE;
     }
     
     aplic_write(dev, config->base + APLIC_DOMAINCFG, 0U);
@@ -269,7 +264,7 @@ static int aplic_configure_direct_mode(const struct device *dev)
     domaincfg |= APLIC_DOMAINCFG_IE_MASK;
     aplic_write(dev, config->base + APLIC_DOMAINCFG, domaincfg);
      
-    data->direct_interrupts = 0;
+    atomic_clear(&data->direct_interrupts);
     return 0;
 }
 
@@ -337,12 +332,12 @@ void riscv_aplic_irq_enable(uint32_t irq)
     const struct aplic_config *config;
     struct aplic_data *data;
      
-    if (!dev) {
+    if (unlikely(!dev)) {
         return;
     }
      
     config = dev->config;
-    if ((irq == 0U) || (irq > config->num_sources)) {
+    if (unlikely((irq == 0U) || (irq > config->num_sources))) {
         LOG_ERR("APLIC: Invalid IRQ number %u", irq);
         return;
     }
@@ -366,12 +361,12 @@ void riscv_aplic_irq_disable(uint32_t irq)
     const struct aplic_config *config;
     struct aplic_data *data;
      
-    if (!dev) {
+    if (unlikely(!dev)) {
         return;
     }
      
     config = dev->config;
-    if ((irq == 0U) || (irq > config->num_sources)) {
+    if (unlikely((irq == 0U) || (irq > config->num_sources))) {
         LOG_ERR("APLIC: Invalid IRQ number %u", irq);
         return;
     }
@@ -388,6 +383,82 @@ void riscv_aplic_irq_disable(uint32_t irq)
 
 }
  
+static void aplic_ie_update_mask(uint32_t base_irq, uint32_t mask, bool enable)
+{
+    const struct device *dev = aplic_get_dev();
+    const struct aplic_config *config;
+    struct aplic_data *data;
+
+    if (unlikely(!dev) || mask == 0U) {
+        return;
+    }
+
+    config = dev->config;
+    if ((base_irq == 0U) || ((base_irq + find_msb_set(mask) - 1U) > config->num_sources)) {
+        LOG_ERR("APLIC: Invalid IRQ mask (base %u, mask 0x%08x)", base_irq, mask);
+        return;
+    }
+
+    uint32_t hw_word = base_irq / 32U;
+    uint32_t hw_shift = base_irq % 32U;
+    mem_addr_t ie_addr = config->base + (enable ? APLIC_SETIE_BASE : APLIC_CLRIE_BASE) +
+                         (hw_word * sizeof(uint32_t));
+
+    aplic_write(dev, ie_addr, mask << hw_shift);
+    if ((hw_shift != 0U) && ((mask >> (32U - hw_shift)) != 0U)) {
+        aplic_write(dev, ie_addr + sizeof(uint32_t), mask >> (32U - hw_shift));
+    }
+
+    data = dev->data;
+    uint32_t sh_word = (base_irq - 1U) / 32U;
+    uint32_t sh_shift = (base_irq - 1U) % 32U;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    if (enable) {
+        data->ie_shadow[sh_word] |= mask << sh_shift;
+        if ((sh_shift != 0U) && ((mask >> (32U - sh_shift)) != 0U)) {
+            data->ie_shadow[sh_word + 1U] |= mask >> (32U - sh_shift);
+        }
+    } else {
+        data->ie_shadow[sh_word] &= ~(mask << sh_shift);
+        if ((sh_shift != 0U) && ((mask >> (32U - sh_shift)) != 0U)) {
+            data->ie_shadow[sh_word + 1U] &= ~(mask >> (32U - sh_shift));
+        }
+    }
+    k_spin_unlock(&data->lock, key);
+}
+
+void riscv_aplic_irq_enable_mask(uint32_t base_irq, uint32_t mask)
+{
+    aplic_ie_update_mask(base_irq, mask, true);
+}
+
+void riscv_aplic_irq_disable_mask(uint32_t base_irq, uint32_t mask)
+{
+    aplic_ie_update_mask(base_irq, mask, false);
+}
+
+static void aplic_ie_update_range(uint32_t base_irq, uint32_t count, bool enable)
+{
+    while (count > 0U) {
+        uint32_t chunk = MIN(count, 32U);
+        uint32_t mask = (chunk == 32U) ? 0xFFFFFFFFU : (uint32_t)(BIT(chunk) - 1U);
+
+        aplic_ie_update_mask(base_irq, mask, enable);
+        base_irq += chunk;
+        count -= chunk;
+    }
+}
+
+void riscv_aplic_irq_enable_range(uint32_t base_irq, uint32_t count)
+{
+    aplic_ie_update_range(base_irq, count, true);
+}
+
+void riscv_aplic_irq_disable_range(uint32_t base_irq, uint32_t count)
+{
+    aplic_ie_update_range(base_irq, count, false);
+}
+
 int riscv_aplic_irq_is_enabled(uint32_t irq)
 {
     const struct device *dev = aplic_get_dev();
@@ -395,12 +466,12 @@ int riscv_aplic_irq_is_enabled(uint32_t irq)
     struct aplic_data *data;
     uint32_t word, bit;
      
-    if (!dev) {
+    if (unlikely(!dev)) {
         return 0;
     }
      
     config = dev->config;
-    if ((irq == 0U) || (irq > config->num_sources)) {
+    if (unlikely((irq == 0U) || (irq > config->num_sources))) {
         LOG_ERR("APLIC: Invalid IRQ number %u", irq);
         return 0;
     }
@@ -418,12 +489,12 @@ void riscv_aplic_set_priority(uint32_t irq, uint32_t prio)
     mem_addr_t targetcfg_addr;
     uint32_t targetcfg_value;
      
-    if (!dev) {
+    if (unlikely(!dev)) {
         return;
     }
      
     config = dev->config;
-    if ((irq == 0U) || (irq > config->num_sources)) {
+    if (unlikely((irq == 0U) || (irq > config->num_sources))) {
         LOG_ERR("APLIC: Invalid IRQ number %u", irq);
         return;
     }
@@ -435,17 +506,15 @@ void riscv_aplic_set_priority(uint32_t irq, uint32_t prio)
     targetcfg_addr = get_targetcfg_addr(dev, irq);
     targetcfg_value = aplic_read(dev, targetcfg_addr);
 
-    targetcfg_value &= ~(APLIC_TARGETCFG_PRIORITY_MASK << APLIC_TARGETCFG_PRIORITY_SHIFT);
-    targetcfg_value |= (prio & APLIC_TARGETCFG_PRIORITY_MASK)
+    uint32_t new_targetcfg = targetcfg_value;
+
+    new_targetcfg &= ~(APLIC_TARGETCFG_PRIORITY_MASK << APLIC_TARGETCFG_PRIORITY_SHIFT);
+    new_targetcfg |= (prio & APLIC_TARGETCFG_PRIORITY_MASK)
              << APLIC_TARGETCFG_PRIORITY_SHIFT;
 
-    aplic_write(dev, targetcfg_addr, targetcfg_value);
-    
-    uint32_t verify_targetcfg = aplic_read(dev, targetcfg_addr);
-    uint32_t verify_hart = (verify_targetcfg >> APLIC_TARGETCFG_HART_SHIFT) & APLIC_TARGETCFG_HART_MASK;
-    uint32_t verify_prio = (verify_targetcfg >> APLIC_TARGETCFG_PRIORITY_SHIFT) & APLIC_TARGETCFG_PRIORITY_MASK;
-    
-    (void)verify_targetcfg; (void)verify_hart; (void)verify_prio; (void)irq; (void)targetcfg_value;
+    if (new_targetcfg != targetcfg_value) {
+        aplic_write(dev, targetcfg_addr, new_targetcfg);
+    }
  }
  
 void riscv_aplic_irq_set_pending(uint32_t irq)
@@ -453,60 +522,47 @@ void riscv_aplic_irq_set_pending(uint32_t irq)
     const struct device *dev = aplic_get_dev();
     const struct aplic_config *config;
 
-    if (!dev) {
+    if (unlikely(!dev)) {
         return;
     }
 
     config = dev->config;
-    if ((irq == 0U) || (irq > config->num_sources)) {
+    if (unlikely((irq == 0U) || (irq > config->num_sources))) {
         LOG_ERR("APLIC: Invalid IRQ number %u", irq);
         return;
     }
 
-    mem_addr_t sourcecfg_addr = get_sourcecfg_addr(dev, irq);
-    uint32_t sourcecfg_value = aplic_read(dev, sourcecfg_addr);
-    
-    if ((sourcecfg_value & APLIC_SOURCECFG_SM_MASK) == APLIC_SOURCECFG_SM_INACTIVE) {
-        LOG_ERR("APLIC: Cannot set pending for INACTIVE source %u (config=0x%08x)", 
-                irq, sourcecfg_value);
-        return;
-    }
-
     struct aplic_data *data = dev->data;
     uint32_t word = (irq - 1U) / 32U;
     uint32_t bit = (irq - 1U) % 32U;
+
+    if ((data->sm_active_shadow[word] & BIT(bit)) == 0U) {
+        LOG_ERR("APLIC: Cannot set pending for INACTIVE source %u", irq);
+        return;
+    }
+
     bool is_enabled = (data->ie_shadow[word] & BIT(bit)) != 0;
     
     if (!is_enabled) {
         LOG_WRN("APLIC: Setting pending for disabled interrupt %u", irq);
     }
 
-    uint32_t setip_word = (irq - 1U) / 32U;
-    uint32_t setip_bit = (irq - 1U) % 32U;
-    mem_addr_t clrip_addr = config->base + APLIC_CLRIP_BASE + (setip_word * sizeof(uint32_t));
-    aplic_write(dev, clrip_addr, BIT(setip_bit));
-    
-    k_busy_wait(100);
-    
-    mem_addr_t setipnum_addr = config->base + APLIC_SETIPNUM_LE;   
-    aplic_write(dev, setipnum_addr, irq);  
+    mem_addr_t setipnum_addr = config->base + APLIC_SETIPNUM_LE;
+    aplic_write(dev, setipnum_addr, irq);
     __asm__ volatile("fence w,w" ::: "memory");
-    
 }
 
 int riscv_aplic_irq_is_pending(uint32_t irq)
 {
     const struct device *dev = aplic_get_dev();
-    
-    if (!dev) {
+    const struct aplic_config *config;
+
+    if (unlikely(!dev)) {
         return 0;
     }
 
-    uint32_t topi = aplic_get_idc_topi(dev, 0);
-    uint32_t pending_irq = (topi >> APLIC_IDC_TOPI_ID_SHIFT) & APLIC_IDC_TOPI_ID_MASK;
-    const struct aplic_config *config = dev->config;
-
-    if (irq > config->num_sources || irq == 0) {
+    config = dev->config;
+    if (unlikely(irq > config->num_sources || irq == 0)) {
         return 0;
     }
 
@@ -514,23 +570,26 @@ int riscv_aplic_irq_is_pending(uint32_t irq)
     uint32_t setip_bit = (irq - 1U) % 32U;
     mem_addr_t setip_addr = config->base + APLIC_SETIP_BASE + (setip_word * sizeof(uint32_t));
     uint32_t setip_value = aplic_read(dev, setip_addr);
-    uint32_t is_pending = (setip_value >> setip_bit) & 1U;
 
-    if (pending_irq == irq) {
+    if (((setip_value >> setip_bit) & 1U) != 0U) {
         return 1;
     }
-    
-    return is_pending;
+
+    /* A claimed-but-unhandled source is reported through TOPI only */
+    uint32_t topi = aplic_get_idc_topi(dev, 0);
+    uint32_t pending_irq = (topi >> APLIC_IDC_TOPI_ID_SHIFT) & APLIC_IDC_TOPI_ID_MASK;
+
+    return pending_irq == irq;
 }
 
  unsigned int riscv_aplic_get_irq(void)
  {
-    return save_irq[arch_curr_cpu()->id];
+    return aplic_cpu[arch_curr_cpu()->id].save_irq;
  }
  
  const struct device *riscv_aplic_get_dev(void)
  {
-    const struct device *dev = save_dev[arch_curr_cpu()->id];
+    const struct device *dev = aplic_cpu[arch_curr_cpu()->id].save_dev;
     return dev ? dev : aplic_dev;
  }
  
@@ -545,10 +604,8 @@ int riscv_aplic_irq_is_pending(uint32_t irq)
      }
      
      data = dev->data;
-     k_spinlock_key_t key = k_spin_lock(&data->lock);
-     count = data->total_interrupts;
-     k_spin_unlock(&data->lock, key);
-     
+     count = (uint32_t)atomic_get(&data->total_interrupts);
+
      return count;
  }
  
@@ -568,10 +625,8 @@ uint32_t riscv_aplic_get_direct_interrupts(void)
     }
      
     data = dev->data;
-    k_spinlock_key_t key = k_spin_lock(&data->lock);
-    count = data->direct_interrupts;
-    k_spin_unlock(&data->lock, key);
-     
+    count = (uint32_t)atomic_get(&data->direct_interrupts);
+
     return count;
 }
  
@@ -585,12 +640,10 @@ void riscv_aplic_reset_stats(void)
     }
      
     data = dev->data;
-    k_spinlock_key_t key = k_spin_lock(&data->lock);
-    data->total_interrupts = 0;
-    data->direct_interrupts = 0;
-    k_spin_unlock(&data->lock, key);
-     
-    LOG_INF("APLIC: Statistics reset");
+    atomic_clear(&data->total_interrupts);
+    atomic_clear(&data->direct_interrupts);
+
+    LOG_DBG("APLIC: Statistics reset");
 }
  
 int riscv_aplic_set_hart_threshold(uint32_t hart_id, uint32_t threshold)
@@ -671,14 +724,22 @@ int riscv_aplic_route_source(uint32_t irq, uint32_t hart)
     aplic_write(dev, sourcecfg_addr, sourcecfg_value);
     
     uint32_t read_sourcecfg = aplic_read(dev, sourcecfg_addr);
-    LOG_INF("APLIC: Source %u config: wrote=0x%08x, read=0x%08x", irq, sourcecfg_value, read_sourcecfg);
-    
+
     if (read_sourcecfg == APLIC_SOURCECFG_SM_INACTIVE) {
         LOG_ERR("APLIC: Source %u is INACTIVE - SETIP writes will be ignored!", irq);
+    }
+
+    struct aplic_data *data = dev->data;
+    uint32_t word = (irq - 1U) / 32U;
+    uint32_t bit = (irq - 1U) % 32U;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    if ((read_sourcecfg & APLIC_SOURCECFG_SM_MASK) != APLIC_SOURCECFG_SM_INACTIVE) {
+        data->sm_active_shadow[word] |= BIT(bit);
     } else {
-        LOG_INF("APLIC: Source %u is ACTIVE (mode=0x%x)", irq, read_sourcecfg & APLIC_SOURCECFG_SM_MASK);
+        data->sm_active_shadow[word] &= ~BIT(bit);
     }
-    
+    k_spin_unlock(&data->lock, key);
+
     targetcfg_addr = get_targetcfg_addr(dev, irq);
     targetcfg_value = ((hart & APLIC_TARGETCFG_HART_MASK) << APLIC_TARGETCFG_HART_SHIFT);
     
@@ -713,11 +774,12 @@ static int aplic_init(const struct device *dev)
         return -EINVAL;
     }
      
-    data->total_interrupts = 0;
-    data->direct_interrupts = 0;
+    atomic_clear(&data->total_interrupts);
+    atomic_clear(&data->direct_interrupts);
 
     for (int w = 0; w < (CONFIG_APLIC_MAX_IRQS + 31) / 32; w++) {
         data->ie_shadow[w] = 0U;
+        data->sm_active_shadow[w] = 0U;
     }
      
     ret = aplic_configure_direct_mode(dev);
@@ -18,6 +18,22 @@ void riscv_aplic_irq_enable(uint32_t irq);
  * @brief Disable interrupt
  */
 void riscv_aplic_irq_disable(uint32_t irq);
+/**
+ * @brief Enable a mask of interrupts, bit n maps to base_irq + n
+ */
+void riscv_aplic_irq_enable_mask(uint32_t base_irq, uint32_t mask);
+/**
+ * @brief Disable a mask of interrupts, bit n maps to base_irq + n
+ */
+void riscv_aplic_irq_disable_mask(uint32_t base_irq, uint32_t mask);
+/**
+ * @brief Enable count contiguous interrupts starting at base_irq
+ */
+void riscv_aplic_irq_enable_range(uint32_t base_irq, uint32_t count);
+/**
+ * @brief Disable count contiguous interrupts starting at base_irq
+ */
+void riscv_aplic_irq_disable_range(uint32_t base_irq, uint32_t count);
 /**
  * @brief Check enabled
  */
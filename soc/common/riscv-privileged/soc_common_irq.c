@@ -51,12 +51,10 @@ void z_riscv_irq_vector_set(unsigned int irq)
 
 void arch_irq_enable(unsigned int irq)
 {
-	uint32_t mie;
-
 #if defined(CONFIG_RISCV_HAS_APLIC)
 	unsigned int level = irq_get_level(irq);
 
-	if (level == 2) {
+	if (unlikely(level == 2)) {
 		riscv_aplic_irq_enable(irq_from_level_2(irq));
 		return;
 	}
@@ -71,19 +69,17 @@ void arch_irq_enable(unsigned int irq)
 
 	/*
 	 * CSR mie register is updated using atomic instruction csrrs
-	 * (atomic read and set bits in CSR register)
+	 * (atomic set bits in CSR register, the old value is not needed)
 	 */
-	mie = csr_read_set(mie, 1 << irq);
+	csr_set(mie, 1 << irq);
 }
 
 void arch_irq_disable(unsigned int irq)
 {
-	uint32_t mie;
-
 #if defined(CONFIG_RISCV_HAS_APLIC)
 	unsigned int level = irq_get_level(irq);
 
-	if (level == 2) {
+	if (unlikely(level == 2)) {
 		riscv_aplic_irq_disable(irq_from_level_2(irq));
 		return;
 	}
@@ -98,9 +94,9 @@ void arch_irq_disable(unsigned int irq)
 
 	/*
 	 * Use atomic instruction csrrc to disable device interrupt in mie CSR.
-	 * (atomic read and clear bits in CSR register)
+	 * (atomic clear bits in CSR register, the old value is not needed)
 	 */
-	mie = csr_read_clear(mie, 1 << irq);
+	csr_clear(mie, 1 << irq);
 }
 
 int arch_irq_is_enabled(unsigned int irq)
@@ -110,7 +106,7 @@ int arch_irq_is_enabled(unsigned int irq)
 #if defined(CONFIG_RISCV_HAS_APLIC)
 	unsigned int level = irq_get_level(irq);
 
-	if (level == 2) {
+	if (unlikely(level == 2)) {
 		return riscv_aplic_irq_is_enabled(irq_from_level_2(irq));
 	}
 #elif defined(CONFIG_RISCV_HAS_PLIC)
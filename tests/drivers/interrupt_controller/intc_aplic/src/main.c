@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2025 Institute of Software, Chinese Academy of Sciences (ISCAS)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+ZTEST_SUITE(aplic_smoke, NULL, NULL, NULL, NULL, NULL);
+
+/* TODO: exercise the APLIC register interface once a platform with an
+ * APLIC node is available in CI; until then report the suite as skipped
+ * rather than vacuously green.
+ */
+ZTEST(aplic_smoke, test_compile_only)
+{
+	ztest_test_skip();
+}